@@ -89,8 +89,12 @@ namespace lsp
                 virtual void        init(plug::IWrapper *wrapper, plug::IPort **ports);
                 void                destroy();
 
+            protected:
+                void                prime_state();
+
             public:
                 virtual void        update_sample_rate(long sr);
+                virtual void        activated();
                 virtual void        update_settings();
                 virtual void        process(size_t samples);
                 virtual void        dump(dspu::IStateDumper *v) const;
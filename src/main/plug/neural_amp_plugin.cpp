@@ -218,6 +218,31 @@ namespace lsp
                 c->sLine.init(dspu::millis_to_samples(sr, meta::neural_amp_plugin::DELAY_OUT_MAX_TIME));
                 c->sBypass.init(sr);
             }
+
+            // Buffers have been re-allocated, bring them to the steady state
+            prime_state();
+        }
+
+        void neural_amp_plugin::activated()
+        {
+            // The host is about to (re)start streaming audio, drop the history
+            // left from the previous run to avoid replaying stale signal
+            prime_state();
+        }
+
+        void neural_amp_plugin::prime_state()
+        {
+            if (vChannels == NULL)
+                return;
+
+            // The steady state of the processing chain for silent input is known
+            // in advance: all history is zero. So we just reset the state instead
+            // of feeding the settling signal through the processors.
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c    = &vChannels[i];
+                c->sLine.clear();
+            }
         }
 
         void neural_amp_plugin::update_settings()
@@ -266,15 +291,15 @@ namespace lsp
                     size_t count            = lsp_min(samples - n, BUFFER_SIZE);
 
                     // Pre-process signal (fill buffer)
-                    c->sLine.process_ramping(vBuffer, in, c->fWetGain, c->nDelay, samples);
+                    c->sLine.process_ramping(vBuffer, in, c->fWetGain, c->nDelay, count);
 
                     // Apply 'dry' control
                     if (c->fDryGain > 0.0f)
                         dsp::fmadd_k3(vBuffer, in, c->fDryGain, count);
 
                     // Compute the gain of input and output signal.
-                    in_gain             = lsp_max(in_gain, dsp::abs_max(in, samples));
-                    out_gain            = lsp_max(out_gain, dsp::abs_max(vBuffer, samples));
+                    in_gain             = lsp_max(in_gain, dsp::abs_max(in, count));
+                    out_gain            = lsp_max(out_gain, dsp::abs_max(vBuffer, count));
 
                     // Process the
                     //  - dry (unprocessed) signal stored in 'in'